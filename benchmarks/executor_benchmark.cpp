@@ -0,0 +1,121 @@
+// Накладные расходы PriorityExecutor по сравнению с "голой" двоичной кучей.
+//
+// Запуск: run_executor_benchmark [кол-во задач] [кол-во потоков]
+//
+// Выводится:
+//  - время Insert + Extract одной задачи в MinBinaryHeap (нижняя граница стоимости диспетчеризации);
+//  - время на задачу в PriorityExecutor при поштучной (Submit) и пакетной (SubmitBatch) постановке;
+//  - перцентили времени ожидания задач в очереди.
+//
+// Задачи пустые: общая для всех потоков запись (например, в std::atomic) добавила бы
+// к накладным расходам диспетчеризации конкуренцию за кэш-линию.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>  // strtol
+#include <iostream>
+#include <random>
+#include <utility>  // pair
+#include <vector>
+
+#include "assignment/min_binary_heap.hpp"
+#include "assignment/priority_executor.hpp"
+
+using namespace assignment;
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  constexpr int kBatchSize = 64;
+
+  volatile std::int64_t sink = 0;
+
+  double ns_per_task(Clock::time_point start, Clock::time_point end, int num_tasks) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return static_cast<double>(ns) / num_tasks;
+  }
+
+  void print_latency(const LatencyStats& stats) {
+    std::cout << "  queueing latency (ns): p50 " << stats.p50 << ", p90 " << stats.p90 << ", p99 " << stats.p99
+              << ", max " << stats.max << '\n';
+  }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+
+  const int num_tasks = argc > 1 ? static_cast<int>(std::strtol(argv[1], nullptr, 10)) : 1'000'000;
+  const int num_workers = argc > 2 ? static_cast<int>(std::strtol(argv[2], nullptr, 10)) : 4;
+
+  if (num_tasks <= 0 || num_workers <= 0) {
+    std::cerr << "number of tasks and workers must be positive\n";
+    return EXIT_FAILURE;
+  }
+
+  auto priorities = std::vector<int>(static_cast<std::size_t>(num_tasks));
+  auto engine = std::mt19937{7};
+  auto distribution = std::uniform_int_distribution<int>{0, 1'000'000};
+
+  for (auto& priority : priorities) {
+    priority = distribution(engine);
+  }
+
+  std::cout << "tasks: " << num_tasks << ", workers: " << num_workers << '\n';
+
+  // куча без исполнителя: Insert + Extract на каждую задачу
+  {
+    auto heap = MinBinaryHeap(num_tasks);
+
+    const auto start = Clock::now();
+    for (int task = 0; task < num_tasks; ++task) {
+      heap.Insert(priorities[static_cast<std::size_t>(task)], task);
+    }
+    while (const auto value = heap.Extract()) {
+      sink = sink + value.value();
+    }
+    const auto end = Clock::now();
+
+    std::cout << "heap:     " << ns_per_task(start, end, num_tasks) << " ns/task\n";
+  }
+
+  // поштучная постановка работающему исполнителю
+  {
+    auto executor = PriorityExecutor(num_workers, num_tasks);
+    executor.Start();
+
+    const auto start = Clock::now();
+    for (int task = 0; task < num_tasks; ++task) {
+      executor.Submit(priorities[static_cast<std::size_t>(task)], [] {});
+    }
+    executor.Wait();
+    const auto end = Clock::now();
+
+    std::cout << "submit:   " << ns_per_task(start, end, num_tasks) << " ns/task\n";
+    print_latency(executor.latency());
+  }
+
+  // пакетная постановка (одно пробуждение на пачку)
+  {
+    auto executor = PriorityExecutor(num_workers, num_tasks);
+    executor.Start();
+
+    const auto start = Clock::now();
+    for (int first = 0; first < num_tasks; first += kBatchSize) {
+      auto batch = std::vector<std::pair<int, PriorityExecutor::Task>>{};
+
+      for (int task = first; task < num_tasks && task < first + kBatchSize; ++task) {
+        batch.emplace_back(priorities[static_cast<std::size_t>(task)], [] {});
+      }
+
+      executor.SubmitBatch(std::move(batch));
+    }
+    executor.Wait();
+    const auto end = Clock::now();
+
+    std::cout << "batch:    " << ns_per_task(start, end, num_tasks) << " ns/task\n";
+    print_latency(executor.latency());
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+// Сравнение плоской (MinBinaryHeap) и блочной (BlockedMinBinaryHeap) раскладок двоичной кучи.
+//
+// Запуск: run_benchmarks [кол-во узлов] [высота блока]
+//
+// Для каждой раскладки выводится:
+//  - среднее время Insert и Extract (нс/операцию);
+//  - среднее кол-во различных страниц (4 КБ) и кэш-линий (64 Б), которые затрагивает путь от корня к листу
+//    (по фактическим адресам узлов в памяти). Это модель промахов TLB и кэша для heapify;
+//    реальные счетчики можно снять через `perf stat -e dTLB-load-misses`.
+
+#include <chrono>
+#include <cstdint>  // int64_t, uintptr_t
+#include <cstdlib>  // strtol
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "assignment/min_binary_heap.hpp"
+#include "assignment/blocked_min_binary_heap.hpp"
+
+using namespace assignment;
+
+namespace {
+
+  constexpr std::uintptr_t kPageSize = 4096;
+  constexpr std::uintptr_t kCacheLineSize = 64;
+
+  // доступ к адресам узлов в памяти
+  struct InspectableMinBinaryHeap : MinBinaryHeap {
+    using MinBinaryHeap::MinBinaryHeap;
+
+    std::uintptr_t address(int index) const {
+      return reinterpret_cast<std::uintptr_t>(&data_[index]);
+    }
+  };
+
+  struct InspectableBlockedMinBinaryHeap : BlockedMinBinaryHeap {
+    using BlockedMinBinaryHeap::BlockedMinBinaryHeap;
+
+    std::uintptr_t address(int index) const {
+      return reinterpret_cast<std::uintptr_t>(&data_[position(index)]);
+    }
+  };
+
+  struct PathStats {
+    double pages{0.0};
+    double cache_lines{0.0};
+  };
+
+  // среднее кол-во различных блоков памяти на случайных путях от корня к листу
+  template <typename Heap>
+  PathStats path_stats(const Heap& heap, int num_nodes, int num_paths) {
+    auto engine = std::mt19937{42};
+    auto leaf = std::uniform_int_distribution<int>{num_nodes / 2, num_nodes - 1};
+
+    std::int64_t pages = 0;
+    std::int64_t lines = 0;
+
+    for (int path = 0; path < num_paths; ++path) {
+      auto touched_pages = std::set<std::uintptr_t>{};
+      auto touched_lines = std::set<std::uintptr_t>{};
+
+      for (int index = leaf(engine); ; index = parent_index(index)) {
+        const std::uintptr_t address = heap.address(index);
+        touched_pages.insert(address / kPageSize);
+        touched_lines.insert(address / kCacheLineSize);
+
+        if (index == 0) {
+          break;
+        }
+      }
+
+      pages += static_cast<std::int64_t>(touched_pages.size());
+      lines += static_cast<std::int64_t>(touched_lines.size());
+    }
+
+    return {static_cast<double>(pages) / num_paths, static_cast<double>(lines) / num_paths};
+  }
+
+  // среднее время операций Insert и Extract (нс/операцию)
+  std::pair<double, double> time_operations(BinaryHeap& heap, const std::vector<int>& keys) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto insert_start = Clock::now();
+    for (const int key : keys) {
+      heap.Insert(key, key);
+    }
+    const auto insert_end = Clock::now();
+
+    volatile std::int64_t checksum = 0;
+    const auto extract_start = Clock::now();
+    while (const auto value = heap.Extract()) {
+      checksum = checksum + value.value();
+    }
+    const auto extract_end = Clock::now();
+
+    const auto ns = [](auto duration) {
+      return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+
+    const auto num_keys = static_cast<double>(keys.size());
+    return {ns(insert_end - insert_start) / num_keys, ns(extract_end - extract_start) / num_keys};
+  }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+
+  const int num_nodes = argc > 1 ? static_cast<int>(std::strtol(argv[1], nullptr, 10)) : 1 << 22;
+  const int block_height = argc > 2 ? static_cast<int>(std::strtol(argv[2], nullptr, 10))
+                                    : BlockedMinBinaryHeap::kDefaultBlockHeight;
+
+  if (num_nodes <= 0) {
+    std::cerr << "number of nodes must be positive\n";
+    return EXIT_FAILURE;
+  }
+
+  constexpr int kNumPaths = 10000;
+
+  auto keys = std::vector<int>(static_cast<std::size_t>(num_nodes));
+  auto engine = std::mt19937{7};
+  auto distribution = std::uniform_int_distribution<int>{};
+
+  for (auto& key : keys) {
+    key = distribution(engine);
+  }
+
+  std::cout << "nodes: " << num_nodes << ", block height: " << block_height << '\n';
+
+  {
+    auto heap = std::make_unique<InspectableMinBinaryHeap>(num_nodes);
+    const auto [insert_ns, extract_ns] = time_operations(*heap, keys);
+    const auto stats = path_stats(*heap, num_nodes, kNumPaths);
+
+    std::cout << "flat:    insert " << insert_ns << " ns/op, extract " << extract_ns << " ns/op, pages/path "
+              << stats.pages << ", cache lines/path " << stats.cache_lines << '\n';
+  }
+
+  {
+    auto heap = std::make_unique<InspectableBlockedMinBinaryHeap>(num_nodes, block_height);
+    const auto [insert_ns, extract_ns] = time_operations(*heap, keys);
+    const auto stats = path_stats(*heap, num_nodes, kNumPaths);
+
+    std::cout << "blocked: insert " << insert_ns << " ns/op, extract " << extract_ns << " ns/op, pages/path "
+              << stats.pages << ", cache lines/path " << stats.cache_lines << '\n';
+  }
+
+  return EXIT_SUCCESS;
+}
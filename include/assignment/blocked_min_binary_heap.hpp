@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>  // int64_t
+#include <vector>
+
+#include "assignment/private/node.hpp"             // Node
+#include "assignment/private/binary_heap.hpp"      // BinaryHeap
+#include "assignment/private/heap_algorithms.hpp"  // parent_index, left_child_index, right_child_index
+
+namespace assignment {
+
+  /**
+   * Минимальная двоичная куча с блочным (B-heap) размещением узлов в памяти.
+   *
+   * Логически это та же двоичная куча, что и MinBinaryHeap: узлы нумеруются по уровням слева направо,
+   * навигация по дереву выполняется через parent_index / left_child_index / right_child_index.
+   * Специфично для раскладки только преобразование логического индекса в позицию в массиве (position).
+   *
+   * Физически дерево разбито на поддеревья высоты block_height, каждое из которых хранится
+   * в отдельном непрерывном блоке из 2^block_height узлов (один слот не используется).
+   * Блоки образуют дерево с 2^block_height потомками и хранятся по уровням этого дерева.
+   * Путь от корня к листу проходит через depth / block_height блоков вместо depth страниц
+   * плоского массива, поэтому при больших размерах кучи heapify делает кратно меньше промахов TLB и кэша.
+   *
+   * Высота по умолчанию подобрана так, чтобы блок занимал страницу памяти в 4 КБ (512 узлов по 8 байт).
+   * Для блоков размером с кэш-линию (64 байта) подходит block_height = 3.
+   * Массив узлов выравнивается по размеру блока (но не больше страницы), так что блок не пересекает границу страницы.
+   *
+   * Последний (неполный) уровень блоков хранится плотно, без выравнивания и неиспользуемых слотов.
+   * Накладные расходы памяти относительно плоского массива не превышают 2^block_height / (2^block_height - 1)
+   * (0.2% при высоте 9) плюс не более 2^(block_height - 1) слотов.
+   *
+   * Цена блочной раскладки - вычисление позиции узла на каждом шаге sift_up и heapify,
+   * поэтому Insert (короткий путь вверх по куче) примерно вдвое медленнее, чем у MinBinaryHeap.
+   * Выигрыш в Extract не гарантирован: при 4 млн узлов Extract не быстрее плоской кучи,
+   * заметное ускорение появляется лишь на кучах в десятки миллионов узлов.
+   *
+   * Бенчмарк run_benchmarks сообщает модельное кол-во страниц и кэш-линий на пути от корня к листу
+   * (по адресам узлов), а не аппаратные счетчики промахов TLB и кэша.
+   */
+  struct BlockedMinBinaryHeap : BinaryHeap {
+   protected:
+    // поля структуры
+    int size_{0};
+    int capacity_{0};
+    int block_height_{0};
+    Node* data_{nullptr};
+
+    // физический размер массива узлов (с учетом неиспользуемых слотов блоков)
+    std::int64_t data_size_{0};
+
+    // для каждого уровня блоков: смещение уровня в массиве и кол-во слотов в блоке
+    std::vector<std::int64_t> level_offset_;
+    std::vector<std::int64_t> level_block_size_;
+
+    // последний уровень: кол-во блоков, содержащих нижний ряд, и размер остальных (укороченных) блоков
+    std::int64_t last_level_split_{0};
+    std::int64_t last_level_short_block_size_{0};
+
+   public:
+    // максимальное кол-во узлов в двоичной куче по умолчанию
+    static constexpr int kDefaultCapacity = 1 + 2 + 4 + 8 + 16;
+
+    // высота поддерева в блоке: 2^9 узлов * 8 байт = страница в 4 КБ
+    static constexpr int kDefaultBlockHeight = 9;
+
+    /**
+     * Создание двоичной кучи указанной емкости.
+     *
+     * @param capacity - значение емкости двоичной кучи
+     * @param block_height - высота поддерева, хранимого в одном блоке (от 1 до 16)
+     */
+    explicit BlockedMinBinaryHeap(int capacity = kDefaultCapacity, int block_height = kDefaultBlockHeight);
+
+    /**
+     * Высвобождение выделенной памяти.
+     *
+     * Поля устанавливаются в нулевые значения.
+     */
+    ~BlockedMinBinaryHeap() override;
+
+    // копирование запрещено (владеет памятью узлов)
+    BlockedMinBinaryHeap(const BlockedMinBinaryHeap&) = delete;
+    BlockedMinBinaryHeap& operator=(const BlockedMinBinaryHeap&) = delete;
+
+    /**
+     * Вставка узла в двоичную кучу.
+     *
+     * Разрешена вставка существующих ключей.
+     *
+     * @param key - значение ключа
+     * @param value - хранимые данные
+     * @return true - успешная вставка, false - при превышении значения емкости
+     */
+    bool Insert(int key, int value) override;
+
+    /**
+     * Извлечение корневого узла из двоичной кучи.
+     *
+     * @return хранимые данные корневого узла или ничего (при пустой куче)
+     */
+    std::optional<int> Extract() override;
+
+    /**
+     * Удаление узла из двоичной кучи по ключу.
+     *
+     * @param key - значение ключа удаляемого узла
+     * @return true - успешное удаление, false - узел с ключом не найден
+     */
+    bool Remove(int key) override;
+
+    /**
+     * Очистка двоичной кучи.
+     *
+     * Сброс текущего размера кучи до нулевого значения.
+     * Выделенная память не высвобождается.
+     */
+    void Clear() override;
+
+    /**
+     * Поиск узла по ключу в двоичной куче.
+     *
+     * @param key - значение ключа
+     * @return хранимые данные или ничего (если узел с ключом не найден)
+     */
+    std::optional<int> Search(int key) const override;
+
+    /**
+     * Проверка наличия узла в двоичной куче по ключу.
+     *
+     * @param key - значение ключа
+     * @return true - узел найден, false - узла с ключом не существует
+     */
+    bool Contains(int key) const override;
+
+    /**
+     * Проверка пустоты двоичной кучи.
+     *
+     * @return true - куча пустая, false - куча не пустая
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает установленную емкость двоичной кучи.
+     *
+     * @return значение емкости
+     */
+    int capacity() const override;
+
+    /**
+     * Возвращает текущий размер двоичной кучи.
+     *
+     * @return значение кол-ва узлов в куче
+     */
+    int size() const override;
+
+    /**
+     * Возвращает высоту поддерева, хранимого в одном блоке.
+     *
+     * @return значение высоты блока
+     */
+    int block_height() const;
+
+    /**
+     * Преобразование логического индекса узла (нумерация по уровням) в индекс в массиве узлов.
+     *
+     * Заменяет собой parent_index / left_child_index плоской кучи: навигация по дереву
+     * выполняется в логических индексах, а обращения к памяти - по результату этой функции.
+     *
+     * @param index - логический индекс узла
+     * @return индекс узла в массиве
+     */
+    std::int64_t position(int index) const;
+
+   private:
+    /**
+     * Преобразование логического индекса узла известной глубины в индекс в массиве узлов.
+     *
+     * @param index - логический индекс узла
+     * @param depth - глубина узла (0 - корень)
+     * @return индекс узла в массиве
+     */
+    std::int64_t position(int index, int depth) const;
+
+    /**
+     * Поднятие узла с указанным логическим индексом по двоичной куче.
+     *
+     * @param index - логический индекс поднимаемого узла
+     */
+    void sift_up(int index);
+
+    /**
+     * Спуск узла с указанным логическим индексом по двоичной куче.
+     *
+     * @param index - логический индекс спускаемого узла
+     */
+    void heapify(int index);
+
+    /**
+     * Поиск логического индекса узла по ключу.
+     *
+     * @param key - значение ключа узла
+     * @return логический индекс найденного узла или ничего (при его отсутствии)
+     */
+    std::optional<int> search_index(int key) const;
+  };
+
+}  // namespace assignment
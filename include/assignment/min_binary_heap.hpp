@@ -1,43 +1,13 @@
 #pragma once
 
 #include <vector>
-#include <utility>  // swap
 
-#include "assignment/private/node.hpp"         // Node
-#include "assignment/private/binary_heap.hpp"  // BinaryHeap
+#include "assignment/private/node.hpp"             // Node
+#include "assignment/private/binary_heap.hpp"      // BinaryHeap
+#include "assignment/private/heap_algorithms.hpp"  // parent_index, heap::sift_up, heap::heapify
 
 namespace assignment {
 
-  /**
-   * Возвращает индекс родительского узла.
-   *
-   * @param index - индекс узла
-   * @return индекс родительского узла
-   */
-  inline constexpr int parent_index(int index) {
-    return (index - 1) / 2;
-  }
-
-  /**
-   * Возвращает индекс левого потомка для узла.
-   *
-   * @param index - индекс узла
-   * @return индекс левого потомка
-   */
-  inline constexpr int left_child_index(int index) {
-    return 2 * index + 1;
-  }
-
-  /**
-   * Возвращает индекс правого потомка для узла.
-   *
-   * @param index - индекс узла
-   * @return индекс правого потомка
-   */
-  inline constexpr int right_child_index(int index) {
-    return 2 * index + 2;
-  }
-
   /**
    * Структура данных "двоичная куча".
    *
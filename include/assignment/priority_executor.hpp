@@ -0,0 +1,289 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>  // int64_t
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>  // pair
+#include <vector>
+
+#include "assignment/min_binary_heap.hpp"  // MinBinaryHeap
+
+namespace assignment {
+
+  /**
+   * Перцентили времени ожидания задач в очереди (от постановки до начала выполнения), в наносекундах.
+   *
+   * Перцентили приближенные: с точностью до корзины гистограммы (12.5% от значения).
+   */
+  struct LatencyStats {
+    std::int64_t count{0};
+    std::int64_t p50{0};
+    std::int64_t p90{0};
+    std::int64_t p99{0};
+    std::int64_t max{0};
+  };
+
+  /**
+   * Гистограмма задержек фиксированного размера.
+   *
+   * Значения до 8 нс хранятся точно, большие - в корзинах по 8 на каждую степень двойки
+   * (старшие 3 бита после ведущей единицы), так что память не растет с кол-вом задач.
+   */
+  struct LatencyHistogram {
+    // кол-во корзин на степень двойки (2^kSubBucketBits)
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kNumBuckets = 64 << kSubBucketBits;
+
+    std::array<std::int64_t, kNumBuckets> buckets{};
+    std::int64_t count{0};
+    std::int64_t max{0};
+
+    /**
+     * Учет значения задержки.
+     *
+     * @param ns - задержка в наносекундах
+     */
+    void Record(std::int64_t ns);
+
+    /**
+     * Добавление значений другой гистограммы.
+     *
+     * @param other - гистограмма
+     */
+    void Merge(const LatencyHistogram& other);
+
+    /**
+     * Вычисление перцентилей.
+     *
+     * @return статистика задержек
+     */
+    LatencyStats Stats() const;
+  };
+
+  /**
+   * Исполнитель задач с приоритетами.
+   *
+   * У каждого рабочего потока своя очередь - двоичная куча MinBinaryHeap (ключ - приоритет,
+   * значение - номер ячейки с задачей). Внутри одной очереди задачи выполняются в порядке возрастания
+   * ключа приоритета (меньший ключ - раньше). Задачи распределяются по очередям по кругу, поэтому
+   * при нескольких потоках порядок между очередями не гарантируется и соблюдается лишь приблизительно. Поток без задач забирает (steal) у другого потока
+   * пачку из нескольких наиболее приоритетных задач и переносит их в свою кучу.
+   *
+   * SubmitBatch учитывает всю пачку в счетчиках за одну блокировку, блокирует каждую очередь
+   * один раз на ее долю пачки и будит потоки один раз на всю пачку.
+   *
+   * Емкость очередей ограничена, как и у MinBinaryHeap: при заполнении всех очередей задача не принимается.
+   * Задачи не должны выбрасывать исключений.
+   *
+   * Задачи, поставленные до Start, ожидают запуска потоков; это позволяет накопить очередь заранее.
+   */
+  struct PriorityExecutor final {
+    using Task = std::function<void()>;
+
+    // емкость очереди одного рабочего потока по умолчанию
+    static constexpr int kDefaultQueueCapacity = 1024;
+
+    // кол-во задач, забираемых у другого потока за раз
+    static constexpr int kDefaultStealBatch = 8;
+
+    /**
+     * Создание исполнителя (потоки не запускаются).
+     *
+     * @param num_workers - кол-во рабочих потоков
+     * @param queue_capacity - емкость очереди одного потока
+     * @param steal_batch - кол-во задач, забираемых у другого потока за раз
+     */
+    explicit PriorityExecutor(int num_workers, int queue_capacity = kDefaultQueueCapacity,
+                              int steal_batch = kDefaultStealBatch);
+
+    /**
+     * Остановка исполнителя (см. Shutdown).
+     */
+    ~PriorityExecutor();
+
+    PriorityExecutor(const PriorityExecutor&) = delete;
+    PriorityExecutor& operator=(const PriorityExecutor&) = delete;
+
+    /**
+     * Запуск рабочих потоков.
+     *
+     * @throw std::logic_error - при повторном запуске или запуске после Shutdown
+     */
+    void Start();
+
+    /**
+     * Постановка задачи в очередь.
+     *
+     * @param priority - ключ приоритета (меньше - раньше)
+     * @param task - задача
+     * @return true - задача принята, false - все очереди заполнены или исполнитель остановлен
+     */
+    bool Submit(int priority, Task task);
+
+    /**
+     * Постановка пачки задач в очереди с одним пробуждением потоков на всю пачку.
+     *
+     * Задачи, не поместившиеся ни в одну очередь, отбрасываются.
+     *
+     * @param tasks - пары (приоритет, задача)
+     * @return кол-во принятых задач
+     */
+    int SubmitBatch(std::vector<std::pair<int, Task>> tasks);
+
+    /**
+     * Ожидание завершения всех принятых задач.
+     *
+     * Исполнитель должен быть запущен.
+     */
+    void Wait();
+
+    /**
+     * Остановка исполнителя.
+     *
+     * Если потоки запущены, дожидается выполнения всех принятых задач и завершает потоки.
+     * Задачи, поставленные без запуска потоков, отбрасываются.
+     */
+    void Shutdown();
+
+    /**
+     * Перцентили времени ожидания выполненных задач в очереди.
+     *
+     * @return статистика задержек
+     */
+    LatencyStats latency() const;
+
+    /**
+     * Возвращает кол-во задач, перенесенных из чужих очередей (work stealing).
+     *
+     * @return значение кол-ва перенесенных задач
+     */
+    std::int64_t stolen() const;
+
+    /**
+     * Возвращает кол-во рабочих потоков.
+     *
+     * @return значение кол-ва потоков
+     */
+    int num_workers() const;
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    // задача в очереди
+    struct Entry {
+      int priority{0};
+      Task task;
+      Clock::time_point submitted;
+    };
+
+    // очередь рабочего потока
+    struct Worker {
+      mutable std::mutex mutex;
+      MinBinaryHeap heap;
+
+      // ячейки для задач (значение узла кучи - номер ячейки) и список свободных ячеек
+      std::vector<Entry> slots;
+      std::vector<int> free_slots;
+
+      // время ожидания выполненных задач
+      LatencyHistogram latencies;
+
+      explicit Worker(int capacity);
+    };
+
+    int steal_batch_{0};
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    // номер потока для следующей задачи (распределение по кругу)
+    std::atomic<unsigned> next_worker_{0};
+
+    // кол-во задач в очередях и кол-во принятых, но не выполненных задач
+    std::atomic<int> queued_{0};
+    std::atomic<int> pending_{0};
+
+    // кол-во задач, перенесенных из чужих очередей
+    std::atomic<std::int64_t> stolen_{0};
+
+    bool started_{false};
+    bool stopped_{false};
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+
+    std::mutex done_mutex_;
+    std::condition_variable done_cv_;
+
+    /**
+     * Помещение задачи в очередь потока (вызывается под блокировкой потока).
+     *
+     * @return true - задача помещена, false - очередь заполнена
+     */
+    static bool push(Worker& worker, Entry& entry);
+
+    /**
+     * Извлечение наиболее приоритетной задачи из очереди потока (вызывается под блокировкой потока).
+     */
+    static Entry pop(Worker& worker);
+
+    /**
+     * Помещение задачи в одну из очередей (начиная со следующей по кругу) без учета в счетчиках.
+     */
+    bool place(Entry& entry);
+
+    /**
+     * Прием новой задачи: помещение в одну из очередей и учет в счетчиках.
+     */
+    bool enqueue(Entry& entry);
+
+    /**
+     * Учет времени ожидания задачи перед выполнением (вызывается под блокировкой потока).
+     */
+    static void record(Worker& worker, const Entry& entry);
+
+    /**
+     * Извлечение задачи для выполнения потоком: из своей очереди или пачкой из чужой.
+     *
+     * @return true - задача получена
+     */
+    bool acquire(int index, Entry& entry);
+
+    /**
+     * Забор пачки задач из чужой очереди в свою.
+     *
+     * @return true - пачка забрана
+     */
+    bool steal(int index);
+
+    /**
+     * Выполнение задачи и учет ее завершения.
+     */
+    void run(Entry& entry);
+
+    /**
+     * Уменьшение кол-ва принятых, но не выполненных задач; при достижении нуля будит Wait.
+     *
+     * @param count - кол-во завершенных (или отклоненных) задач
+     */
+    void finish(int count);
+
+    /**
+     * Пробуждение рабочих потоков после постановки задач.
+     *
+     * @param count - кол-во поставленных задач
+     */
+    void wake(int count);
+
+    /**
+     * Главный цикл рабочего потока.
+     */
+    void work(int index);
+  };
+
+}  // namespace assignment
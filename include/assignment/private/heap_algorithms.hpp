@@ -0,0 +1,136 @@
+#pragma once
+
+#include <optional>
+
+#include "assignment/private/node.hpp"  // Node
+
+namespace assignment {
+
+  /**
+   * Возвращает индекс родительского узла.
+   *
+   * @param index - индекс узла
+   * @return индекс родительского узла
+   */
+  inline constexpr int parent_index(int index) {
+    return (index - 1) / 2;
+  }
+
+  /**
+   * Возвращает индекс левого потомка для узла.
+   *
+   * @param index - индекс узла
+   * @return индекс левого потомка
+   */
+  inline constexpr int left_child_index(int index) {
+    return 2 * index + 1;
+  }
+
+  /**
+   * Возвращает индекс правого потомка для узла.
+   *
+   * @param index - индекс узла
+   * @return индекс правого потомка
+   */
+  inline constexpr int right_child_index(int index) {
+    return 2 * index + 2;
+  }
+
+  /**
+   * Алгоритмы двоичной кучи над массивом узлов.
+   *
+   * Общие для кучи с динамической памятью (MinBinaryHeap) и кучи фиксированной емкости (StaticMinHeap).
+   * Все функции constexpr (std::swap становится constexpr только в C++20).
+   */
+  namespace heap {
+
+    /**
+     * Обмен узлов местами.
+     */
+    inline constexpr void swap_nodes(Node& lhs, Node& rhs) {
+      const Node tmp = lhs;
+      lhs = rhs;
+      rhs = tmp;
+    }
+
+    /**
+     * Поднятие узла с указанным индексом по двоичной куче.
+     *
+     * @param data - массив узлов
+     * @param index - значение индекса поднимаемого узла
+     */
+    inline constexpr void sift_up(Node* data, int index) {
+
+      // Алгоритм:
+      // Пока index не равен индексу корневого узла И ключ узла меньше ключа родителя:
+      //  поднимаем "наверх" узел - меняем местами нижний и верхний узлы (swap)
+      //  index = индекс родительского узла
+
+      while (index != 0 && data[index].key < data[parent_index(index)].key) {
+
+        swap_nodes(data[index], data[parent_index(index)]);
+        index = parent_index(index);
+      }
+    }
+
+    /**
+     * Спуск узла с указанным индексом по двоичной куче.
+     *
+     * @param data - массив узлов
+     * @param size - текущий размер кучи
+     * @param index - значение индекса спускаемого узла
+     */
+    inline constexpr void heapify(Node* data, int size, int index) {
+
+      // индексы левого и правого потомков узла с индексом index
+      const int left_index = left_child_index(index);
+      const int right_index = right_child_index(index);
+
+      // вышли за пределы массива, останавливаемся
+      if (left_index >= size) {
+        return;
+      }
+
+      // индекс узла-потомка с наименьшим значением ключа
+      int smallest_key_index = index;
+
+      if (data[left_index].key < data[index].key) {
+        smallest_key_index = left_index;
+      }
+
+      // правого потомка может не быть
+      if (right_index < size && data[right_index].key < data[smallest_key_index].key) {
+        smallest_key_index = right_index;
+      }
+
+      // если индекс наименьшего узла найден (не равен индексу самого узла)
+      if (smallest_key_index != index) {
+
+        // меняем местами родителя и потомка (swap)
+        swap_nodes(data[index], data[smallest_key_index]);
+
+        // рекурсивно спускаемся по куче, следуя индексу
+        heapify(data, size, smallest_key_index);
+      }
+    }
+
+    /**
+     * Поиск индекса узла по ключу.
+     *
+     * @param data - массив узлов
+     * @param size - текущий размер кучи
+     * @param key - значение ключа узла
+     * @return индекс найденного узла или ничего (при его отсутствии)
+     */
+    inline constexpr std::optional<int> search_index(const Node* data, int size, int key) {
+      for (int i = 0; i < size; i++) {
+        if (data[i].key == key) {
+          return i;
+        }
+      }
+      return std::nullopt;
+    }
+
+  }  // namespace heap
+
+}  // namespace assignment
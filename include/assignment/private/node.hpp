@@ -14,7 +14,7 @@ namespace assignment {
 
     // конструкторы
     Node() = default;
-    Node(int key, int value) : key{key}, value{value} {}
+    constexpr Node(int key, int value) : key{key}, value{value} {}
 
     // операторы сравнения
     bool operator==(const Node& other) const;
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>   // size_t
+#include <limits>    // numeric_limits
+#include <optional>
+
+#include "assignment/private/node.hpp"             // Node
+#include "assignment/private/heap_algorithms.hpp"  // heap::sift_up, heap::heapify, heap::search_index
+
+namespace assignment {
+
+  /**
+   * Минимальная двоичная куча фиксированной емкости.
+   *
+   * Узлы хранятся непосредственно в объекте (std::array), динамическая память не выделяется,
+   * виртуальные вызовы отсутствуют. Куча может располагаться на стеке или внутри других объектов,
+   * а все операции доступны на этапе компиляции (constexpr).
+   *
+   * Использует те же алгоритмы sift_up и heapify, что и MinBinaryHeap.
+   *
+   * @tparam N - емкость двоичной кучи
+   */
+  template <std::size_t N>
+  struct StaticMinHeap final {
+    static_assert(N > 0, "capacity must be positive");
+    static_assert(N <= static_cast<std::size_t>(std::numeric_limits<int>::max()), "capacity must fit into int");
+
+   private:
+    // поля структуры
+    int size_{0};
+    std::array<Node, N> data_{};
+
+   public:
+    constexpr StaticMinHeap() = default;
+
+    /**
+     * Вставка узла в двоичную кучу.
+     *
+     * @param key - значение ключа
+     * @param value - хранимые данные
+     * @return true - успешная вставка, false - при превышении значения емкости
+     */
+    constexpr bool Insert(int key, int value) {
+
+      if (static_cast<std::size_t>(size_) == N) {
+        return false;
+      }
+
+      data_[static_cast<std::size_t>(size_)] = Node(key, value);
+      size_ += 1;
+      heap::sift_up(data_.data(), size_ - 1);
+      return true;
+    }
+
+    /**
+     * Извлечение корневого узла из двоичной кучи.
+     *
+     * @return хранимые данные корневого узла или ничего (при пустой куче)
+     */
+    constexpr std::optional<int> Extract() {
+
+      if (size_ == 0) {
+        return std::nullopt;
+      }
+
+      const int root_value = data_[0].value;
+      data_[0] = data_[static_cast<std::size_t>(size_ - 1)];
+      size_ -= 1;
+      heap::heapify(data_.data(), size_, 0);
+      return root_value;
+    }
+
+    /**
+     * Удаление узла из двоичной кучи по ключу.
+     *
+     * @param key - значение ключа удаляемого узла
+     * @return true - успешное удаление, false - узел с ключом не найден
+     */
+    constexpr bool Remove(int key) {
+
+      const auto index = heap::search_index(data_.data(), size_, key);
+
+      if (!index.has_value()) {
+        return false;
+      }
+
+      data_[static_cast<std::size_t>(index.value())].key = std::numeric_limits<int>::min();
+      heap::sift_up(data_.data(), index.value());
+      Extract();
+      return true;
+    }
+
+    /**
+     * Очистка двоичной кучи.
+     */
+    constexpr void Clear() {
+      for (int i = 0; i < size_; i++) {
+        data_[static_cast<std::size_t>(i)] = Node{};
+      }
+      size_ = 0;
+    }
+
+    /**
+     * Поиск узла по ключу в двоичной куче.
+     *
+     * @param key - значение ключа
+     * @return хранимые данные или ничего (если узел с ключом не найден)
+     */
+    constexpr std::optional<int> Search(int key) const {
+      const auto index = heap::search_index(data_.data(), size_, key);
+
+      if (!index.has_value()) {
+        return std::nullopt;
+      }
+
+      return data_[static_cast<std::size_t>(index.value())].value;
+    }
+
+    constexpr bool Contains(int key) const {
+      return Search(key).has_value();
+    }
+
+    constexpr bool IsEmpty() const {
+      return size_ == 0;
+    }
+
+    constexpr int capacity() const {
+      return static_cast<int>(N);
+    }
+
+    constexpr int size() const {
+      return size_;
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,288 @@
+#include "assignment/blocked_min_binary_heap.hpp"
+
+#include <algorithm>  // max, min
+#include <memory>     // uninitialized_fill_n
+#include <new>        // align_val_t
+#include <stdexcept>  // invalid_argument
+#include <limits>     // numeric_limits
+#include <utility>    // swap
+
+namespace assignment {
+
+  namespace {
+
+    // размер страницы памяти, к которой выравниваются блоки
+    constexpr std::size_t kPageSize = 4096;
+
+    // глубина узла с логическим индексом index (floor(log2(index + 1)))
+    int depth_of(int index) {
+      const auto number = static_cast<unsigned>(index) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<int>(sizeof(unsigned) * 8) - 1 - __builtin_clz(number);
+#else
+      int depth = 0;
+      for (unsigned rest = number; rest > 1; rest >>= 1) {
+        depth += 1;
+      }
+      return depth;
+#endif
+    }
+
+    // выравнивание массива узлов: полный блок, но не больше страницы
+    std::align_val_t alignment_of(int block_height) {
+      const std::size_t block_bytes = (std::size_t{1} << block_height) * sizeof(Node);
+      return std::align_val_t{std::max(alignof(Node), std::min(block_bytes, kPageSize))};
+    }
+
+  }  // namespace
+
+  BlockedMinBinaryHeap::BlockedMinBinaryHeap(int capacity, int block_height) {
+
+    if (capacity <= 0) {
+      throw std::invalid_argument("capacity must be positive");
+    }
+
+    if (block_height <= 0 || block_height > 16) {
+      throw std::invalid_argument("block height must be in range [1, 16]");
+    }
+
+    size_ = 0;
+    capacity_ = capacity;
+    block_height_ = block_height;
+
+    // кол-во уровней блоков и высота последнего (неполного) уровня
+    const int max_depth = depth_of(capacity - 1);
+    const int num_levels = max_depth / block_height_ + 1;
+    const int last_level_height = max_depth % block_height_ + 1;
+
+    const std::int64_t fanout = std::int64_t{1} << block_height_;
+
+    std::int64_t offset = 0;
+    std::int64_t num_blocks = 1;
+
+    // полные уровни: блоки из 2^block_height слотов, выровненные по своему размеру
+    for (int level = 0; level + 1 < num_levels; ++level) {
+      level_offset_.push_back(offset);
+      level_block_size_.push_back(std::int64_t{1} << block_height_);
+
+      offset += num_blocks * level_block_size_.back();
+      num_blocks *= fanout;
+    }
+
+    // последний уровень хранится плотно, без выравнивания блоков:
+    // блоки, в которые попадает нижний (неполный) ряд дерева, занимают 2^h - 1 слотов,
+    // остальные - 2^(h-1) - 1 слотов (нижнего ряда в них нет)
+    const std::int64_t last_row_size = capacity - ((std::int64_t{1} << max_depth) - 1);
+    const std::int64_t last_row_per_block = std::int64_t{1} << (last_level_height - 1);
+
+    level_offset_.push_back(offset);
+    level_block_size_.push_back((std::int64_t{1} << last_level_height) - 1);
+
+    last_level_split_ = (last_row_size + last_row_per_block - 1) / last_row_per_block;
+    last_level_short_block_size_ = last_row_per_block - 1;
+
+    // размер массива - наибольшая позиция среди последних узлов каждого ряда
+    data_size_ = 0;
+    for (int depth = 0; depth <= max_depth; ++depth) {
+      const int last_index = depth == max_depth ? capacity - 1 : (1 << (depth + 1)) - 2;
+      data_size_ = std::max(data_size_, position(last_index, depth) + 1);
+    }
+
+    const auto bytes = static_cast<std::size_t>(data_size_) * sizeof(Node);
+    data_ = static_cast<Node*>(::operator new[](bytes, alignment_of(block_height_)));
+    std::uninitialized_fill_n(data_, data_size_, Node{});
+  }
+
+  BlockedMinBinaryHeap::~BlockedMinBinaryHeap() {
+
+    size_ = 0;
+    capacity_ = 0;
+    data_size_ = 0;
+
+    // Node тривиально разрушаем, достаточно освободить память
+    ::operator delete[](data_, alignment_of(block_height_));
+    data_ = nullptr;
+  }
+
+  bool BlockedMinBinaryHeap::Insert(int key, int value) {
+
+    if (size_ == capacity_) {
+      return false;
+    }
+
+    data_[position(size_)] = Node(key, value);
+    size_ += 1;
+    sift_up(size_ - 1);
+    return true;
+  }
+
+  std::optional<int> BlockedMinBinaryHeap::Extract() {
+
+    if (size_ == 0) {
+      return std::nullopt;
+    }
+
+    const int root_value = data_[0].value;
+    data_[0] = data_[position(size_ - 1)];
+    size_ -= 1;
+    heapify(0);
+    return root_value;
+  }
+
+  bool BlockedMinBinaryHeap::Remove(int key) {
+
+    constexpr int min_key_value = std::numeric_limits<int>::min();
+
+    const auto index = search_index(key);
+
+    if (!index.has_value()) {
+      return false;
+    }
+
+    data_[position(index.value())].key = min_key_value;
+    sift_up(index.value());
+    Extract();
+    return true;
+  }
+
+  void BlockedMinBinaryHeap::Clear() {
+    for (int i = 0; i < size_; i++) {
+      data_[position(i)] = Node{};
+    }
+    size_ = 0;
+  }
+
+  std::optional<int> BlockedMinBinaryHeap::Search(int key) const {
+    const auto index = search_index(key);
+    if (!index.has_value()) {
+      return std::nullopt;
+    }
+    return data_[position(index.value())].value;
+  }
+
+  bool BlockedMinBinaryHeap::Contains(int key) const {
+    return Search(key).has_value();
+  }
+
+  bool BlockedMinBinaryHeap::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int BlockedMinBinaryHeap::capacity() const {
+    return capacity_;
+  }
+
+  int BlockedMinBinaryHeap::size() const {
+    return size_;
+  }
+
+  int BlockedMinBinaryHeap::block_height() const {
+    return block_height_;
+  }
+
+  std::int64_t BlockedMinBinaryHeap::position(int index) const {
+    return position(index, depth_of(index));
+  }
+
+  // вспомогательные функции
+
+  std::int64_t BlockedMinBinaryHeap::position(int index, int depth) const {
+
+    // порядковый номер узла на своем уровне дерева
+    const std::int64_t offset = static_cast<std::int64_t>(index) + 1 - (std::int64_t{1} << depth);
+
+    // уровень блоков и глубина узла внутри блока
+    const auto level = static_cast<std::size_t>(depth / block_height_);
+    const int local_depth = depth % block_height_;
+
+    // на глубине local_depth в каждом блоке 2^local_depth узлов
+    const std::int64_t block = offset >> local_depth;
+    const std::int64_t local = (std::int64_t{1} << local_depth) - 1 + (offset & ((std::int64_t{1} << local_depth) - 1));
+
+    const std::int64_t base = level_offset_[level];
+    const std::int64_t block_size = level_block_size_[level];
+
+    if (level + 1 < level_offset_.size() || block < last_level_split_) {
+      return base + block * block_size + local;
+    }
+
+    // укороченные блоки последнего уровня
+    return base + last_level_split_ * block_size + (block - last_level_split_) * last_level_short_block_size_ + local;
+  }
+
+  void BlockedMinBinaryHeap::sift_up(int index) {
+
+    int depth = depth_of(index);
+    std::int64_t current = position(index, depth);
+
+    while (index != 0) {
+      const int parent = parent_index(index);
+      const std::int64_t parent_position = position(parent, depth - 1);
+
+      if (!(data_[current].key < data_[parent_position].key)) {
+        break;
+      }
+
+      std::swap(data_[current], data_[parent_position]);
+
+      index = parent;
+      current = parent_position;
+      depth -= 1;
+    }
+  }
+
+  void BlockedMinBinaryHeap::heapify(int index) {
+
+    int depth = depth_of(index);
+    std::int64_t current = position(index, depth);
+
+    while (true) {
+      const int left_index = left_child_index(index);
+      const int right_index = right_child_index(index);
+
+      // вышли за пределы кучи, останавливаемся
+      if (left_index >= size_) {
+        return;
+      }
+
+      int smallest_index = index;
+      std::int64_t smallest_position = current;
+
+      const std::int64_t left_position = position(left_index, depth + 1);
+
+      if (data_[left_position].key < data_[smallest_position].key) {
+        smallest_index = left_index;
+        smallest_position = left_position;
+      }
+
+      if (right_index < size_) {
+        const std::int64_t right_position = position(right_index, depth + 1);
+
+        if (data_[right_position].key < data_[smallest_position].key) {
+          smallest_index = right_index;
+          smallest_position = right_position;
+        }
+      }
+
+      if (smallest_index == index) {
+        return;
+      }
+
+      std::swap(data_[current], data_[smallest_position]);
+
+      index = smallest_index;
+      current = smallest_position;
+      depth += 1;
+    }
+  }
+
+  std::optional<int> BlockedMinBinaryHeap::search_index(int key) const {
+    for (int i = 0; i < size_; i++) {
+      if (data_[position(i)].key == key) {
+        return i;
+      }
+    }
+    return std::nullopt;
+  }
+
+}  // namespace assignment
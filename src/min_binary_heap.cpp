@@ -127,59 +127,15 @@ namespace assignment {
   // вспомогательные функции
 
   void MinBinaryHeap::sift_up(int index) {
-
-    // Алгоритм:
-    // Пока index не равен индексу корневого узла И ключ узла меньше ключа родителя:
-    //  поднимаем "наверх" узел - меняем местами нижний и верхний узлы (swap)
-    //  index = индекс родительского узла
-
-    while (index != 0 && data_[index].key < data_[parent_index(index)].key) {
-
-      std::swap(data_[index], data_[parent_index(index)]);
-      index = parent_index(index);
-    }
+    heap::sift_up(data_, index);
   }
 
   void MinBinaryHeap::heapify(int index) {
-
-    // индексы левого и правого потомков узла с индексом index
-    const int left_index = left_child_index(index);
-    const int right_index = right_child_index(index);
-
-    // вышли за пределы массива, останавливаемся
-    if (left_index >= size_) {
-      return;
-    }
-
-    // индекс узла-потомка с наименьшим значением ключа
-    int smallest_key_index = index;
-
-    if (data_[left_index].key < data_[index].key) {
-      smallest_key_index = left_index;
-    }
-
-    if (data_[right_index].key < data_[smallest_key_index].key) {
-      smallest_key_index = right_index;
-    }
-
-    // если индекс наименьшего узла найден (не равен индексу самого узла)
-    if (smallest_key_index != index) {
-
-      // меняем местами родителя и потомка (swap)
-      std::swap(data_[index], data_[smallest_key_index]);
-
-      // рекурсивно спускаемся по куче, следуя индексу
-      heapify(smallest_key_index);
-    }
+    heap::heapify(data_, size_, index);
   }
 
   std::optional<int> MinBinaryHeap::search_index(int key) const {
-    for (int i = 0; i < size_; i++){
-      if (data_[i].key == key){
-        return i;
-      }
-    }
-    return std::nullopt;
+    return heap::search_index(data_, size_, key);
   }
 
 }  // namespace assignment
@@ -0,0 +1,474 @@
+#include "assignment/priority_executor.hpp"
+
+#include <algorithm>  // min, max
+#include <stdexcept>  // invalid_argument, logic_error
+
+namespace assignment {
+
+  namespace {
+
+    // номер старшего единичного бита (floor(log2(value))), value > 0
+    int floor_log2(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+      return 63 - __builtin_clzll(value);
+#else
+      int result = 0;
+      for (; value > 1; value >>= 1) {
+        result += 1;
+      }
+      return result;
+#endif
+    }
+
+    constexpr int kSubBuckets = 1 << LatencyHistogram::kSubBucketBits;
+
+    // номер корзины для значения
+    int bucket_of(std::int64_t ns) {
+
+      if (ns < kSubBuckets) {
+        return static_cast<int>(std::max<std::int64_t>(ns, 0));
+      }
+
+      const int exponent = floor_log2(static_cast<std::uint64_t>(ns));
+      const int shift = exponent - LatencyHistogram::kSubBucketBits;
+      const auto mantissa = static_cast<int>((ns >> shift) & (kSubBuckets - 1));
+
+      return (shift + 1) * kSubBuckets + mantissa;
+    }
+
+    // наибольшее значение, попадающее в корзину
+    std::int64_t bucket_upper_bound(int bucket) {
+
+      if (bucket < kSubBuckets) {
+        return bucket;
+      }
+
+      const int shift = bucket / kSubBuckets - 1;
+      const std::int64_t lower = static_cast<std::int64_t>(kSubBuckets + bucket % kSubBuckets) << shift;
+
+      return lower + (std::int64_t{1} << shift) - 1;
+    }
+
+  }  // namespace
+
+  void LatencyHistogram::Record(std::int64_t ns) {
+    buckets[static_cast<std::size_t>(bucket_of(ns))] += 1;
+    count += 1;
+    max = std::max(max, ns);
+  }
+
+  void LatencyHistogram::Merge(const LatencyHistogram& other) {
+    for (std::size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+      buckets[bucket] += other.buckets[bucket];
+    }
+    count += other.count;
+    max = std::max(max, other.max);
+  }
+
+  LatencyStats LatencyHistogram::Stats() const {
+
+    if (count == 0) {
+      return {};
+    }
+
+    // значение, не меньше которого percent% задач
+    const auto percentile = [this](std::int64_t percent) {
+      const std::int64_t rank = (count * percent + 99) / 100;
+
+      std::int64_t seen = 0;
+      for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+        seen += buckets[static_cast<std::size_t>(bucket)];
+
+        if (seen >= rank) {
+          return std::min(bucket_upper_bound(bucket), max);
+        }
+      }
+
+      return max;
+    };
+
+    return {count, percentile(50), percentile(90), percentile(99), max};
+  }
+
+  PriorityExecutor::Worker::Worker(int capacity) : heap(capacity), slots(static_cast<std::size_t>(capacity)) {
+
+    // свободные ячейки выдаются с начала массива
+    free_slots.reserve(static_cast<std::size_t>(capacity));
+    for (int slot = capacity - 1; slot >= 0; --slot) {
+      free_slots.push_back(slot);
+    }
+  }
+
+  PriorityExecutor::PriorityExecutor(int num_workers, int queue_capacity, int steal_batch) {
+
+    if (num_workers <= 0) {
+      throw std::invalid_argument("number of workers must be positive");
+    }
+
+    if (queue_capacity <= 0) {
+      throw std::invalid_argument("queue capacity must be positive");
+    }
+
+    if (steal_batch <= 0) {
+      throw std::invalid_argument("steal batch must be positive");
+    }
+
+    steal_batch_ = steal_batch;
+
+    workers_.reserve(static_cast<std::size_t>(num_workers));
+    for (int index = 0; index < num_workers; ++index) {
+      workers_.push_back(std::make_unique<Worker>(queue_capacity));
+    }
+  }
+
+  PriorityExecutor::~PriorityExecutor() {
+    Shutdown();
+  }
+
+  void PriorityExecutor::Start() {
+
+    if (started_) {
+      throw std::logic_error("executor is already started");
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+
+      // потоки, запущенные после Shutdown, некому было бы завершить
+      if (stopped_) {
+        throw std::logic_error("executor is shut down");
+      }
+    }
+
+    started_ = true;
+
+    threads_.reserve(workers_.size());
+    for (int index = 0; index < num_workers(); ++index) {
+      threads_.emplace_back(&PriorityExecutor::work, this, index);
+    }
+  }
+
+  bool PriorityExecutor::Submit(int priority, Task task) {
+
+    auto entry = Entry{priority, std::move(task), Clock::now()};
+
+    if (!enqueue(entry)) {
+      return false;
+    }
+
+    wake(1);
+    return true;
+  }
+
+  int PriorityExecutor::SubmitBatch(std::vector<std::pair<int, Task>> tasks) {
+
+    const int total = static_cast<int>(tasks.size());
+
+    if (total == 0) {
+      return 0;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+
+      if (stopped_) {
+        return 0;
+      }
+
+      // вся пачка учитывается в счетчиках за одну критическую секцию
+      pending_ += total;
+      queued_ += total;
+    }
+
+    const auto submitted = Clock::now();
+
+    // задача i попадает в очередь (first + i) % num_workers, как при поштучной постановке
+    const auto num_queues = workers_.size();
+    const auto first = static_cast<std::size_t>(next_worker_.fetch_add(static_cast<unsigned>(total)));
+
+    auto overflow = std::vector<Entry>{};
+
+    // каждая очередь блокируется один раз на свою долю пачки
+    for (std::size_t share = 0; share < num_queues && share < tasks.size(); ++share) {
+      auto& worker = *workers_[(first + share) % num_queues];
+
+      std::lock_guard<std::mutex> lock(worker.mutex);
+
+      for (std::size_t task = share; task < tasks.size(); task += num_queues) {
+        auto entry = Entry{tasks[task].first, std::move(tasks[task].second), submitted};
+
+        if (!push(worker, entry)) {
+          overflow.push_back(std::move(entry));
+        }
+      }
+    }
+
+    // задачи, не поместившиеся в свою очередь, пробуем разместить в других
+    int rejected = 0;
+    for (auto& entry : overflow) {
+      if (!place(entry)) {
+        rejected += 1;
+      }
+    }
+
+    if (rejected > 0) {
+      queued_ -= rejected;
+      finish(rejected);
+    }
+
+    const int accepted = total - rejected;
+
+    if (accepted > 0) {
+      wake(accepted);
+    }
+
+    return accepted;
+  }
+
+  void PriorityExecutor::Wait() {
+    std::unique_lock<std::mutex> lock(done_mutex_);
+    done_cv_.wait(lock, [this] { return pending_.load() == 0; });
+  }
+
+  void PriorityExecutor::Shutdown() {
+
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+
+      if (stopped_) {
+        return;
+      }
+
+      stopped_ = true;
+    }
+    wake_cv_.notify_all();
+
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+
+    threads_.clear();
+  }
+
+  LatencyStats PriorityExecutor::latency() const {
+
+    auto histogram = LatencyHistogram{};
+
+    for (const auto& worker : workers_) {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      histogram.Merge(worker->latencies);
+    }
+
+    return histogram.Stats();
+  }
+
+  std::int64_t PriorityExecutor::stolen() const {
+    return stolen_.load();
+  }
+
+  int PriorityExecutor::num_workers() const {
+    return static_cast<int>(workers_.size());
+  }
+
+  // вспомогательные функции
+
+  bool PriorityExecutor::push(Worker& worker, Entry& entry) {
+
+    if (worker.free_slots.empty()) {
+      return false;
+    }
+
+    const int slot = worker.free_slots.back();
+
+    if (!worker.heap.Insert(entry.priority, slot)) {
+      return false;
+    }
+
+    worker.free_slots.pop_back();
+    worker.slots[static_cast<std::size_t>(slot)] = std::move(entry);
+    return true;
+  }
+
+  PriorityExecutor::Entry PriorityExecutor::pop(Worker& worker) {
+
+    const int slot = worker.heap.Extract().value();
+
+    auto entry = std::move(worker.slots[static_cast<std::size_t>(slot)]);
+    worker.slots[static_cast<std::size_t>(slot)].task = nullptr;
+    worker.free_slots.push_back(slot);
+
+    return entry;
+  }
+
+  void PriorityExecutor::record(Worker& worker, const Entry& entry) {
+    const auto waited = Clock::now() - entry.submitted;
+    worker.latencies.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count());
+  }
+
+  bool PriorityExecutor::place(Entry& entry) {
+
+    const unsigned first = next_worker_.fetch_add(1);
+
+    for (int attempt = 0; attempt < num_workers(); ++attempt) {
+      auto& worker = *workers_[(first + static_cast<unsigned>(attempt)) % workers_.size()];
+
+      std::lock_guard<std::mutex> lock(worker.mutex);
+
+      if (push(worker, entry)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool PriorityExecutor::enqueue(Entry& entry) {
+
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+
+      if (stopped_) {
+        return false;
+      }
+
+      // счетчики увеличиваются вместе с проверкой остановки: рабочий поток не завершится,
+      // пока задача учтена в queued_, а Wait не вернется раньше ее выполнения
+      pending_ += 1;
+      queued_ += 1;
+    }
+
+    if (!place(entry)) {
+      queued_ -= 1;
+      finish(1);
+      return false;
+    }
+
+    return true;
+  }
+
+  bool PriorityExecutor::acquire(int index, Entry& entry) {
+
+    auto& worker = *workers_[static_cast<std::size_t>(index)];
+
+    do {
+      std::lock_guard<std::mutex> lock(worker.mutex);
+
+      if (!worker.heap.IsEmpty()) {
+        entry = pop(worker);
+        queued_ -= 1;
+
+        record(worker, entry);
+        return true;
+      }
+    } while (steal(index));
+
+    return false;
+  }
+
+  bool PriorityExecutor::steal(int index) {
+
+    auto batch = std::vector<Entry>{};
+
+    // забираем пачку наиболее приоритетных задач у первого непустого потока
+    for (int offset = 1; offset < num_workers() && batch.empty(); ++offset) {
+      auto& victim = *workers_[static_cast<std::size_t>((index + offset) % num_workers())];
+
+      std::lock_guard<std::mutex> lock(victim.mutex);
+
+      const int count = std::min(steal_batch_, victim.heap.size());
+      for (int i = 0; i < count; ++i) {
+        batch.push_back(pop(victim));
+      }
+    }
+
+    if (batch.empty()) {
+      return false;
+    }
+
+    stolen_ += static_cast<std::int64_t>(batch.size());
+
+    // переносим пачку в свою очередь (блокировки чужой и своей очередей не удерживаются одновременно)
+    auto overflow = std::vector<Entry>{};
+    {
+      auto& worker = *workers_[static_cast<std::size_t>(index)];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+
+      for (auto& stolen : batch) {
+        if (!push(worker, stolen)) {
+          overflow.push_back(std::move(stolen));
+        }
+      }
+    }
+
+    // своя очередь успела заполниться: возвращаем задачи в другие очереди, иначе выполняем сразу
+    for (auto& stolen : overflow) {
+      if (!place(stolen)) {
+        queued_ -= 1;
+
+        {
+          auto& worker = *workers_[static_cast<std::size_t>(index)];
+          std::lock_guard<std::mutex> lock(worker.mutex);
+          record(worker, stolen);
+        }
+
+        run(stolen);
+      }
+    }
+
+    return true;
+  }
+
+  void PriorityExecutor::run(Entry& entry) {
+
+    entry.task();
+    entry.task = nullptr;
+
+    finish(1);
+  }
+
+  void PriorityExecutor::finish(int count) {
+
+    // последняя учтенная задача будит Wait, откуда бы ни пришло уменьшение счетчика
+    if (pending_.fetch_sub(count) == count) {
+      std::lock_guard<std::mutex> lock(done_mutex_);
+      done_cv_.notify_all();
+    }
+  }
+
+  void PriorityExecutor::wake(int count) {
+
+    {
+      // пустая критическая секция исключает потерю пробуждения ожидающего потока
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+    }
+
+    if (count >= num_workers()) {
+      wake_cv_.notify_all();
+    } else {
+      for (int i = 0; i < count; ++i) {
+        wake_cv_.notify_one();
+      }
+    }
+  }
+
+  void PriorityExecutor::work(int index) {
+
+    auto entry = Entry{};
+
+    while (true) {
+
+      if (acquire(index, entry)) {
+        run(entry);
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_cv_.wait(lock, [this] { return stopped_ || queued_.load() > 0; });
+
+      if (stopped_ && queued_.load() == 0) {
+        return;
+      }
+    }
+  }
+
+}  // namespace assignment
@@ -0,0 +1,160 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // sort, max
+#include <cstdint>    // uintptr_t
+#include <set>
+#include <vector>
+
+#include "testing_blocked_min_binary_heap.hpp"
+
+using assignment::BlockedMinBinaryHeap;
+using assignment::TestingBlockedMinBinaryHeap;
+
+SCENARIO("BlockedMinBinaryHeap: BlockedMinBinaryHeap") {
+
+  SECTION("capacity > 0") {
+    const int capacity = GENERATE(range(1, 11));
+
+    const auto heap = BlockedMinBinaryHeap(capacity);
+
+    CHECK(heap.IsEmpty());
+    CHECK(heap.size() == 0);
+    CHECK(heap.capacity() == capacity);
+    CHECK(heap.block_height() == BlockedMinBinaryHeap::kDefaultBlockHeight);
+  }
+
+  SECTION("alignment") {
+    const int capacity = GENERATE(1, 65536, 1 << 20);
+
+    // блок из 512 узлов - ровно страница, блок из 8 узлов - ровно кэш-линия
+    const auto page_heap = TestingBlockedMinBinaryHeap(capacity, 9);
+    const auto line_heap = TestingBlockedMinBinaryHeap(capacity, 3);
+
+    CHECK(reinterpret_cast<std::uintptr_t>(page_heap.data()) % 4096 == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(line_heap.data()) % 64 == 0);
+  }
+
+  SECTION("invalid arguments") {
+    CHECK_THROWS(BlockedMinBinaryHeap(0));
+    CHECK_THROWS(BlockedMinBinaryHeap(10, 0));
+    CHECK_THROWS(BlockedMinBinaryHeap(10, 17));
+  }
+}
+
+SCENARIO("BlockedMinBinaryHeap: position") {
+
+  SECTION("block height 2") {
+    // блоки из 3 узлов (4 слота), у каждого блока 4 блока-потомка
+    const auto heap = BlockedMinBinaryHeap(15, 2);
+
+    // корневой блок
+    CHECK(heap.position(0) == 0);
+    CHECK(heap.position(1) == 1);
+    CHECK(heap.position(2) == 2);
+
+    // узлы глубины 2 - корни блоков последнего уровня (хранятся плотно, по 3 слота)
+    CHECK(heap.position(3) == 4);
+    CHECK(heap.position(4) == 7);
+    CHECK(heap.position(5) == 10);
+    CHECK(heap.position(6) == 13);
+
+    // потомки узла 3 лежат в его блоке
+    CHECK(heap.position(7) == 5);
+    CHECK(heap.position(8) == 6);
+    CHECK(heap.position(9) == 8);
+  }
+
+  SECTION("partial last row") {
+    // нижний ряд заполнен частично: в первых трех блоках по 3 слота, в последнем - 1
+    const auto heap = BlockedMinBinaryHeap(12, 2);
+
+    CHECK(heap.position(5) == 10);
+    CHECK(heap.position(6) == 13);
+    CHECK(heap.position(11) == 11);
+  }
+
+  SECTION("positions are unique") {
+    const int capacity = GENERATE(1, 7, 100, 511, 512, 1000);
+    const int block_height = GENERATE(1, 3, 9);
+
+    const auto heap = BlockedMinBinaryHeap(capacity, block_height);
+
+    auto positions = std::set<std::int64_t>{};
+
+    for (int index = 0; index < capacity; ++index) {
+      CHECK(heap.position(index) >= 0);
+      positions.insert(heap.position(index));
+    }
+
+    CHECK(positions.size() == static_cast<std::size_t>(capacity));
+  }
+
+  SECTION("memory overhead") {
+    const int capacity = GENERATE(1024, 524288, 600000);
+
+    const auto heap = BlockedMinBinaryHeap(capacity);
+
+    std::int64_t max_position = 0;
+
+    for (int index = 0; index < capacity; ++index) {
+      max_position = std::max(max_position, heap.position(index));
+    }
+
+    // 0.2% на выравнивание полных блоков плюс не более половины блока
+    CHECK(max_position + 1 <= capacity + capacity / 500 + 256);
+  }
+}
+
+SCENARIO("BlockedMinBinaryHeap: Insert & Extract") {
+  const int block_height = GENERATE(1, 2, 3, 9);
+  const int capacity = 200;
+
+  auto heap = BlockedMinBinaryHeap(capacity, block_height);
+
+  auto keys = std::vector<int>{};
+
+  for (int index = 0; index < capacity; ++index) {
+    const int key = (index * 7919) % 211;
+    keys.push_back(key);
+    CHECK(heap.Insert(key, key));
+  }
+
+  CHECK_FALSE(heap.Insert(0, 0));
+  CHECK(heap.size() == capacity);
+
+  std::sort(keys.begin(), keys.end());
+
+  for (const int key : keys) {
+    const auto extracted = heap.Extract();
+    REQUIRE(extracted.has_value());
+    CHECK(extracted.value() == key);
+  }
+
+  CHECK(heap.IsEmpty());
+  CHECK_FALSE(heap.Extract().has_value());
+}
+
+SCENARIO("BlockedMinBinaryHeap: Remove & Search") {
+  auto heap = BlockedMinBinaryHeap(31, 2);
+
+  for (int key = 30; key >= 0; --key) {
+    heap.Insert(key, key * 10);
+  }
+
+  CHECK(heap.Search(17) == 170);
+  CHECK(heap.Contains(0));
+  CHECK_FALSE(heap.Contains(31));
+
+  CHECK(heap.Remove(0));
+  CHECK(heap.Remove(17));
+  CHECK_FALSE(heap.Remove(17));
+  CHECK(heap.size() == 29);
+
+  CHECK(heap.Extract() == 10);
+  CHECK(heap.Extract() == 20);
+
+  heap.Clear();
+
+  CHECK(heap.IsEmpty());
+  CHECK(heap.capacity() == 31);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "assignment/blocked_min_binary_heap.hpp"  // BlockedMinBinaryHeap
+
+namespace assignment {
+
+  struct TestingBlockedMinBinaryHeap : BlockedMinBinaryHeap {
+
+    explicit TestingBlockedMinBinaryHeap(int capacity, int block_height = kDefaultBlockHeight)
+        : BlockedMinBinaryHeap(capacity, block_height) {}
+
+    const Node* data() const {
+      return data_;
+    }
+
+    // узлы в логическом порядке (по уровням слева направо)
+    std::vector<Node> toVector() const {
+      auto nodes = std::vector<Node>{};
+      nodes.reserve(static_cast<std::size_t>(size_));
+
+      for (int index = 0; index < size_; ++index) {
+        nodes.push_back(data_[position(index)]);
+      }
+
+      return nodes;
+    }
+  };
+
+}  // namespace assignment
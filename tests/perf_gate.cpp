@@ -0,0 +1,194 @@
+// Проверка производительности основных операций MinBinaryHeap.
+//
+// Измеряет среднее время операций (нс/операцию) и делит его на время эталонной операции в том же запуске
+// (push/pop std::priority_queue и линейный поиск std::find_if на тех же ключах). Отношение не зависит
+// от скорости машины и сравнивается с сохраненным в файле baseline.
+// Завершается с ошибкой, если отношение превышает baseline более чем в kTolerance раз.
+//
+// Запуск: perf_gate <baseline> [--update]
+//  --update - перезаписать baseline текущими измерениями (после изменений, ускоряющих кучу, или на новой машине).
+//
+// Без оптимизаций (сборка не Release) замеры не имеют смысла, и проверка пропускается (код kSkipCode).
+
+#include <algorithm>  // nth_element, find_if
+#include <chrono>
+#include <cstdlib>  // EXIT_SUCCESS, EXIT_FAILURE
+#include <fstream>
+#include <functional>  // greater
+#include <iostream>
+#include <map>
+#include <queue>  // priority_queue
+#include <random>
+#include <string>
+#include <utility>  // pair
+#include <vector>
+
+#include "assignment/min_binary_heap.hpp"
+
+using assignment::MinBinaryHeap;
+using assignment::Node;
+
+namespace {
+
+  // допустимое увеличение отношения к эталону относительно baseline
+  constexpr double kTolerance = 1.5;
+
+  // код возврата для пропуска теста (SKIP_RETURN_CODE в CTest)
+  constexpr int kSkipCode = 77;
+
+  constexpr int kNumRepetitions = 7;
+  constexpr int kLargeHeapSize = 1 << 16;
+  constexpr int kSmallHeapSize = 1 << 10;
+
+  using Clock = std::chrono::steady_clock;
+
+  volatile long long sink = 0;
+
+  double ns_per_op(Clock::time_point start, Clock::time_point end, int num_operations) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return static_cast<double>(ns) / num_operations;
+  }
+
+  // медиана по нескольким повторам сглаживает шум планировщика
+  double median(std::vector<double> samples) {
+    const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+    std::nth_element(samples.begin(), middle, samples.end());
+    return *middle;
+  }
+
+  std::map<std::string, double> measure() {
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{};
+
+    auto keys = std::vector<int>(kLargeHeapSize);
+    for (auto& key : keys) {
+      key = distribution(engine);
+    }
+
+    auto insert_samples = std::vector<double>{};
+    auto extract_samples = std::vector<double>{};
+    auto search_samples = std::vector<double>{};
+
+    for (int repetition = 0; repetition < kNumRepetitions; ++repetition) {
+
+      // эталон: std::priority_queue на тех же ключах
+      auto queue = std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>>{};
+
+      auto start = Clock::now();
+      for (const int key : keys) {
+        queue.emplace(key, key);
+      }
+      const double reference_insert = ns_per_op(start, Clock::now(), kLargeHeapSize);
+
+      start = Clock::now();
+      while (!queue.empty()) {
+        sink = sink + queue.top().second;
+        queue.pop();
+      }
+      const double reference_extract = ns_per_op(start, Clock::now(), kLargeHeapSize);
+
+      auto heap = MinBinaryHeap(kLargeHeapSize);
+
+      start = Clock::now();
+      for (const int key : keys) {
+        heap.Insert(key, key);
+      }
+      insert_samples.push_back(ns_per_op(start, Clock::now(), kLargeHeapSize) / reference_insert);
+
+      start = Clock::now();
+      while (const auto value = heap.Extract()) {
+        sink = sink + value.value();
+      }
+      extract_samples.push_back(ns_per_op(start, Clock::now(), kLargeHeapSize) / reference_extract);
+
+      // поиск - линейный, поэтому измеряется на куче меньшего размера;
+      // эталон - линейный поиск по массиву узлов того же размера
+      auto nodes = std::vector<Node>{};
+      for (int index = 0; index < kSmallHeapSize; ++index) {
+        heap.Insert(keys[static_cast<std::size_t>(index)], index);
+        nodes.emplace_back(keys[static_cast<std::size_t>(index)], index);
+      }
+
+      start = Clock::now();
+      for (int index = 0; index < kSmallHeapSize; ++index) {
+        const int key = keys[static_cast<std::size_t>(kSmallHeapSize - 1 - index)];
+        const auto it = std::find_if(nodes.begin(), nodes.end(), [key](const Node& node) { return node.key == key; });
+        sink = sink + (it != nodes.end() ? it->value : 0);
+      }
+      const double reference_search = ns_per_op(start, Clock::now(), kSmallHeapSize);
+
+      start = Clock::now();
+      for (int index = 0; index < kSmallHeapSize; ++index) {
+        sink = sink + heap.Search(keys[static_cast<std::size_t>(kSmallHeapSize - 1 - index)]).value_or(0);
+      }
+      search_samples.push_back(ns_per_op(start, Clock::now(), kSmallHeapSize) / reference_search);
+    }
+
+    return {{"insert", median(insert_samples)}, {"extract", median(extract_samples)}, {"search", median(search_samples)}};
+  }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+
+#ifndef NDEBUG
+  std::cout << "perf gate skipped: build is not optimized (use CMAKE_BUILD_TYPE=Release)\n";
+  return kSkipCode;
+#endif
+
+  if (argc < 2) {
+    std::cerr << "usage: " << argv[0] << " <baseline> [--update]\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string baseline_path = argv[1];
+  const bool update = argc > 2 && std::string{argv[2]} == "--update";
+
+  const auto results = measure();
+
+  if (update) {
+    auto output = std::ofstream{baseline_path};
+
+    for (const auto& [name, ratio] : results) {
+      output << name << ' ' << ratio << '\n';
+    }
+
+    std::cout << "baseline updated: " << baseline_path << '\n';
+    return EXIT_SUCCESS;
+  }
+
+  auto input = std::ifstream{baseline_path};
+
+  if (!input) {
+    std::cerr << "cannot open baseline: " << baseline_path << '\n';
+    return EXIT_FAILURE;
+  }
+
+  auto baseline = std::map<std::string, double>{};
+
+  std::string name;
+  double ratio = 0.0;
+  while (input >> name >> ratio) {
+    baseline[name] = ratio;
+  }
+
+  bool passed = true;
+
+  for (const auto& [operation, measured] : results) {
+    const auto it = baseline.find(operation);
+
+    if (it == baseline.end()) {
+      std::cerr << operation << ": missing in baseline\n";
+      passed = false;
+      continue;
+    }
+
+    const bool regressed = measured > it->second * kTolerance;
+    passed = passed && !regressed;
+
+    std::cout << operation << ": " << measured << "x reference (baseline " << it->second << "x)"
+              << (regressed ? " REGRESSION" : "") << '\n';
+  }
+
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>  // logic_error
+#include <thread>
+#include <vector>
+
+#include "assignment/priority_executor.hpp"
+
+using assignment::PriorityExecutor;
+
+SCENARIO("PriorityExecutor::PriorityExecutor") {
+  CHECK_THROWS(PriorityExecutor(0));
+  CHECK_THROWS(PriorityExecutor(1, 0));
+  CHECK_THROWS(PriorityExecutor(1, 1, 0));
+
+  auto executor = PriorityExecutor(3);
+
+  CHECK(executor.num_workers() == 3);
+  CHECK(executor.latency().count == 0);
+}
+
+SCENARIO("PriorityExecutor: priority order") {
+  auto executor = PriorityExecutor(1);
+
+  auto order = std::vector<int>{};
+
+  // задачи ставятся до запуска потока, поэтому выполняются строго по приоритету
+  for (const int priority : {5, 1, 4, 2, 3}) {
+    REQUIRE(executor.Submit(priority, [&order, priority] { order.push_back(priority); }));
+  }
+
+  executor.Start();
+  executor.Wait();
+
+  CHECK(order == std::vector<int>{1, 2, 3, 4, 5});
+  CHECK(executor.latency().count == 5);
+}
+
+SCENARIO("PriorityExecutor: capacity") {
+  auto executor = PriorityExecutor(2, 2);
+
+  auto batch = std::vector<std::pair<int, PriorityExecutor::Task>>{};
+  for (int priority = 0; priority < 6; ++priority) {
+    batch.emplace_back(priority, [] {});
+  }
+
+  CHECK(executor.SubmitBatch(std::move(batch)) == 4);
+  CHECK_FALSE(executor.Submit(0, [] {}));
+
+  executor.Start();
+  executor.Wait();
+
+  CHECK(executor.Submit(0, [] {}));
+}
+
+SCENARIO("PriorityExecutor: Wait with rejected submits") {
+  // Wait должен проснуться, даже если счетчик принятых задач обнулил отклоненный Submit,
+  // выполнявшийся одновременно с завершением последней задачи
+  constexpr int kNumIterations = 100;
+  constexpr int kNumWorkers = 2;
+
+  int hangs = 0;
+
+  for (int iteration = 0; iteration < kNumIterations; ++iteration) {
+    auto executor = PriorityExecutor(kNumWorkers, 1, 1);
+    executor.Start();
+
+    std::atomic<bool> release{false};
+    std::atomic<bool> stop{false};
+    std::atomic<int> running{0};
+
+    // все потоки заняты задачами-"шлагбаумами"
+    for (int worker = 0; worker < kNumWorkers; ++worker) {
+      REQUIRE(executor.Submit(0, [&] {
+        running += 1;
+        while (!release.load()) {
+          std::this_thread::yield();
+        }
+      }));
+    }
+
+    while (running.load() < kNumWorkers) {
+      std::this_thread::yield();
+    }
+
+    // все очереди заполнены; их задачи останавливают постановку
+    for (int filled = 0; filled < kNumWorkers;) {
+      filled += executor.Submit(1, [&stop] { stop = true; }) ? 1 : 0;
+    }
+
+    // пока очереди заполнены, все Submit отклоняются
+    auto submitters = std::vector<std::thread>{};
+    for (int thread = 0; thread < 2; ++thread) {
+      submitters.emplace_back([&] {
+        while (!stop.load()) {
+          executor.Submit(2, [] {});
+        }
+      });
+    }
+
+    auto waiter = std::async(std::launch::async, [&executor] { executor.Wait(); });
+
+    // Wait успевает заблокироваться до освобождения потоков
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    release = true;
+
+    for (auto& submitter : submitters) {
+      submitter.join();
+    }
+
+    if (waiter.wait_for(std::chrono::seconds(1)) != std::future_status::ready) {
+      hangs += 1;
+
+      // будим Wait еще одной задачей, чтобы тест завершился
+      executor.Submit(0, [] {});
+      waiter.wait();
+    }
+  }
+
+  CHECK(hangs == 0);
+}
+
+SCENARIO("PriorityExecutor: many tasks") {
+  constexpr int kNumTasks = 10'000;
+
+  auto executor = PriorityExecutor(4, kNumTasks, 16);
+
+  std::atomic<int> executed{0};
+
+  for (int task = 0; task < kNumTasks; ++task) {
+    REQUIRE(executor.Submit(task, [&executed] { executed += 1; }));
+  }
+
+  executor.Start();
+  executor.Wait();
+
+  CHECK(executed == kNumTasks);
+
+  const auto latency = executor.latency();
+
+  CHECK(latency.count == kNumTasks);
+  CHECK(latency.p50 <= latency.p90);
+  CHECK(latency.p90 <= latency.p99);
+  CHECK(latency.p99 <= latency.max);
+
+  executor.Shutdown();
+
+  CHECK_FALSE(executor.Submit(0, [] {}));
+  CHECK_THROWS_AS(executor.Start(), std::logic_error);
+}
+
+SCENARIO("PriorityExecutor: work stealing") {
+  constexpr int kNumTasks = 1'000;
+
+  auto executor = PriorityExecutor(2, kNumTasks, 4);
+
+  std::atomic<int> executed{0};
+  std::atomic<bool> drained{false};
+
+  // задача-"шлагбаум" блокирует выполнивший ее поток, пока не выполнены все остальные задачи;
+  // половина из них лежит в очереди заблокированного потока, и забрать их можно только кражей
+  REQUIRE(executor.Submit(-1, [&] {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (executed.load() < kNumTasks && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+
+    drained = executed.load() == kNumTasks;
+  }));
+
+  for (int task = 0; task < kNumTasks; ++task) {
+    REQUIRE(executor.Submit(task, [&executed] { executed += 1; }));
+  }
+
+  executor.Start();
+  executor.Wait();
+
+  CHECK(drained);
+  CHECK(executor.stolen() > 0);
+  CHECK(executor.latency().count == kNumTasks + 1);
+}
+
+SCENARIO("PriorityExecutor: latency histogram") {
+  auto histogram = assignment::LatencyHistogram{};
+
+  for (std::int64_t ns = 1; ns <= 1000; ++ns) {
+    histogram.Record(ns * 1000);
+  }
+
+  const auto stats = histogram.Stats();
+
+  CHECK(stats.count == 1000);
+  CHECK(stats.max == 1'000'000);
+
+  // точность - корзина в 12.5% от значения
+  CHECK(stats.p50 >= 500'000);
+  CHECK(stats.p50 <= 500'000 * 9 / 8);
+  CHECK(stats.p99 >= 990'000);
+  CHECK(stats.p99 <= 1'000'000);
+}
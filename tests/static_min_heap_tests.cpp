@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+
+#include "assignment/static_min_heap.hpp"
+
+using assignment::StaticMinHeap;
+
+namespace {
+
+  constexpr StaticMinHeap<7> make_heap() {
+    StaticMinHeap<7> heap;
+    heap.Insert(17, 3);
+    heap.Insert(2, 1);
+    heap.Insert(36, 5);
+    heap.Insert(1, 0);
+    heap.Insert(7, 6);
+    return heap;
+  }
+
+  constexpr int extract_after_remove() {
+    auto heap = make_heap();
+    heap.Remove(1);
+    return heap.Extract().value();
+  }
+
+}  // namespace
+
+// constexpr-пригодность проверяется на этапе компиляции
+static_assert(make_heap().size() == 5);
+static_assert(make_heap().capacity() == 7);
+static_assert(make_heap().Contains(36));
+static_assert(!make_heap().Contains(0));
+static_assert(extract_after_remove() == 1);
+
+SCENARIO("StaticMinHeap") {
+  auto heap = StaticMinHeap<4>();
+
+  REQUIRE(heap.IsEmpty());
+  REQUIRE(heap.capacity() == 4);
+
+  SECTION("insert & extract") {
+    CHECK(heap.Insert(3, 30));
+    CHECK(heap.Insert(1, 10));
+    CHECK(heap.Insert(4, 40));
+    CHECK(heap.Insert(2, 20));
+    CHECK_FALSE(heap.Insert(0, 0));
+
+    CHECK(heap.size() == 4);
+
+    CHECK(heap.Extract() == 10);
+    CHECK(heap.Extract() == 20);
+    CHECK(heap.Extract() == 30);
+    CHECK(heap.Extract() == 40);
+    CHECK_FALSE(heap.Extract().has_value());
+  }
+
+  SECTION("remove & search") {
+    heap.Insert(3, 30);
+    heap.Insert(1, 10);
+    heap.Insert(4, 40);
+
+    CHECK(heap.Search(4) == 40);
+    CHECK(heap.Remove(1));
+    CHECK_FALSE(heap.Remove(1));
+    CHECK_FALSE(heap.Search(1).has_value());
+
+    CHECK(heap.Extract() == 30);
+
+    heap.Clear();
+
+    CHECK(heap.IsEmpty());
+  }
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch.hpp>
+
+#include <functional>  // greater
+#include <queue>       // priority_queue
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "testing_min_binary_heap.hpp"
+#include "testing_blocked_min_binary_heap.hpp"
+
+using assignment::Node;
+using assignment::parent_index;
+using assignment::TestingMinBinaryHeap;
+using assignment::TestingBlockedMinBinaryHeap;
+
+namespace {
+
+  constexpr int kNumOperations = 2'000'000;
+  constexpr int kBatchSize = 10'000;
+  constexpr int kCapacity = 1024;
+  constexpr int kMaxKey = 4096;
+
+  // проверка свойства минимальной кучи: родитель не больше потомков
+  bool is_min_heap(const std::vector<Node>& nodes) {
+    for (int index = 1; index < static_cast<int>(nodes.size()); ++index) {
+      if (nodes[static_cast<std::size_t>(index)].key < nodes[static_cast<std::size_t>(parent_index(index))].key) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Эталон на основе std::priority_queue.
+   *
+   * Удаление по ключу реализовано "лениво": ключ помечается удаленным
+   * и выбрасывается при попадании в вершину очереди.
+   */
+  struct ReferenceHeap {
+    std::priority_queue<int, std::vector<int>, std::greater<>> queue;
+    std::unordered_map<int, int> counts;
+    std::unordered_map<int, int> removed;
+    int size{0};
+
+    void Insert(int key) {
+      queue.push(key);
+      counts[key] += 1;
+      size += 1;
+    }
+
+    std::optional<int> Extract() {
+      drop_removed();
+
+      if (queue.empty()) {
+        return std::nullopt;
+      }
+
+      const int key = queue.top();
+      queue.pop();
+      counts[key] -= 1;
+      size -= 1;
+      return key;
+    }
+
+    bool Remove(int key) {
+      if (!Contains(key)) {
+        return false;
+      }
+
+      counts[key] -= 1;
+      removed[key] += 1;
+      size -= 1;
+      return true;
+    }
+
+    bool Contains(int key) const {
+      const auto it = counts.find(key);
+      return it != counts.end() && it->second > 0;
+    }
+
+    void Clear() {
+      queue = {};
+      counts.clear();
+      removed.clear();
+      size = 0;
+    }
+
+   private:
+    void drop_removed() {
+      while (!queue.empty()) {
+        const auto it = removed.find(queue.top());
+
+        if (it == removed.end() || it->second == 0) {
+          return;
+        }
+
+        it->second -= 1;
+        queue.pop();
+      }
+    }
+  };
+
+  // случайная последовательность операций над кучей и эталоном (значение узла совпадает с ключом)
+  template <typename Heap>
+  void run_differential(Heap& heap, unsigned seed) {
+    auto engine = std::mt19937{seed};
+    auto key_distribution = std::uniform_int_distribution<int>{-kMaxKey, kMaxKey};
+    auto operation_distribution = std::uniform_int_distribution<int>{0, 999};
+
+    auto reference = ReferenceHeap{};
+
+    for (int operation = 1; operation <= kNumOperations; ++operation) {
+      const int choice = operation_distribution(engine);
+      const int key = key_distribution(engine);
+
+      if (choice < 550) {
+        const bool inserted = heap.Insert(key, key);
+        REQUIRE(inserted == (reference.size < kCapacity));
+
+        if (inserted) {
+          reference.Insert(key);
+        }
+      } else if (choice < 990) {
+        REQUIRE(heap.Extract() == reference.Extract());
+      } else if (choice < 995) {
+        REQUIRE(heap.Remove(key) == reference.Remove(key));
+      } else if (choice < 999) {
+        REQUIRE(heap.Contains(key) == reference.Contains(key));
+      } else {
+        heap.Clear();
+        reference.Clear();
+      }
+
+      if (operation % kBatchSize == 0) {
+        REQUIRE(heap.size() == reference.size);
+        REQUIRE(is_min_heap(heap.toVector()));
+      }
+    }
+  }
+
+}  // namespace
+
+SCENARIO("MinBinaryHeap: differential stress vs std::priority_queue", "[.][stress]") {
+  const unsigned seed = GENERATE(1u, 2u);
+
+  auto heap = TestingMinBinaryHeap(kCapacity);
+  run_differential(heap, seed);
+}
+
+SCENARIO("BlockedMinBinaryHeap: differential stress vs std::priority_queue", "[.][stress]") {
+  const int block_height = GENERATE(2, 9);
+
+  auto heap = TestingBlockedMinBinaryHeap(kCapacity, block_height);
+  run_differential(heap, 3u);
+}